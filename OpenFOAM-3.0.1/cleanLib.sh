@@ -9,6 +9,8 @@ make distclean
 rm -rf fftw.timeStamp
 cd ../..
 wclean
+wclean applications/lduSolverBenchmark
+wclean applications/pumpDataToAscii
 
 #
 #END-OF-FILE
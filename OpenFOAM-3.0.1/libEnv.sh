@@ -2,6 +2,21 @@
 
 export FFTW_LIB=fftw-3.3.3
 
+# OpenMP threads of the solvers (nThreads), used only if the compiler
+# supports it; without it the library builds and runs on one thread
+if [ -z "${OPENMP_FLAGS+set}" ]
+then
+    if echo 'int main() { return 0; }' \
+        | ${WM_CXX:-g++} -fopenmp -x c++ - -o /dev/null 2>/dev/null
+    then
+        export OPENMP_FLAGS=-fopenmp
+        export OPENMP_LIBS=-lgomp
+    else
+        export OPENMP_FLAGS=
+        export OPENMP_LIBS=
+    fi
+fi
+
 #
 #END-OF-FILE
 #
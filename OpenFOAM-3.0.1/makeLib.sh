@@ -11,7 +11,8 @@ then
 
     CFLAGS=-fPIC\\
     CXXFLAGS=-fPIC\\
-    ./configure --prefix=$FOAM_USER_LIBBIN/$FFTW_LIB --enable-shared
+    ./configure --prefix=$FOAM_USER_LIBBIN/$FFTW_LIB --enable-shared \
+	--enable-threads --enable-sse2 --enable-avx
 
     make
     make install
@@ -29,7 +30,16 @@ fi
 
 cd $THIS_DIR
 
+# OPENMP_FLAGS and OPENMP_LIBS from libEnv.sh enable the threaded solvers,
+# pthreads (FFTW threads, asynchronous PumpStat output) are always needed
+if [ -z "$OPENMP_FLAGS" ]
+then
+    echo "No OpenMP support found, building the solvers single-threaded"
+fi
+
 wmake libso
+wmake applications/lduSolverBenchmark
+wmake applications/pumpDataToAscii
 #
 #END-OF-FILE
 #